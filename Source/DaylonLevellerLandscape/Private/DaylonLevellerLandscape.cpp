@@ -4,6 +4,17 @@
 #include "LandscapeModule.h"
 #include "LandscapeEditorModule.h"
 #include "LandscapeFileFormatInterface.h"
+#include "Containers/Ticker.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+#if PLATFORM_LINUX
+#include <sys/mman.h>
+#elif PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#endif
 
 
 
@@ -13,6 +24,17 @@
 DEFINE_LOG_CATEGORY(LogDaylonLevellerLandscape)
 
 
+static TAutoConsoleVariable<int32> CVarBufferPoolBudgetMB(
+	TEXT("Daylon.Leveller.BufferPoolBudgetMB"),
+	512,
+	TEXT("Maximum megabytes of idle document buffers the Leveller importer keeps for reuse. 0 disables pooling."));
+
+static TAutoConsoleVariable<float> CVarBufferPoolIdleSeconds(
+	TEXT("Daylon.Leveller.BufferPoolIdleSeconds"),
+	30.0f,
+	TEXT("Idle document buffers older than this many seconds are freed."));
+
+
 namespace Daylon
 {
 enum ECoordsys
@@ -178,13 +200,262 @@ static const FMeasurementUnit kUnits[] =
 };
 
 
+// Size-classed pool of large aligned buffers. Batch and repeated imports load
+// documents of the same few sizes over and over, so handing back a warm buffer
+// avoids the allocation, page faults and zeroing of a fresh one each time.
+class FLevellerBufferPool
+{
+	public:
+
+		static constexpr int64 kMinClassSize = 2 * 1024 * 1024; // one huge page on x64
+
+		static FLevellerBufferPool& Get()
+		{
+			static FLevellerBufferPool Pool;
+			return Pool;
+		}
+
+		uint8* Acquire(int64 Size, int64& OutCapacity)
+		{
+			OutCapacity = ClassSize(Size);
+
+			{
+				FScopeLock Lock(&CriticalSection);
+
+				InUseBytes += OutCapacity;
+
+				// Most recently released first, since it is the likeliest to still be resident.
+				for(int32 I = FreeList.Num() - 1; I >= 0; I--)
+				{
+					if(FreeList[I].Capacity == OutCapacity)
+					{
+						uint8* Ptr = FreeList[I].Ptr;
+						FreeList.RemoveAt(I, 1, EAllowShrinking::No);
+						RetainedBytes -= OutCapacity;
+						Hits++;
+						return Ptr;
+					}
+				}
+
+				Misses++;
+			}
+
+			uint8* Ptr = Allocate(OutCapacity);
+
+			if(Ptr == nullptr)
+			{
+				FScopeLock Lock(&CriticalSection);
+				InUseBytes -= OutCapacity;
+				OutCapacity = 0;
+			}
+
+			return Ptr;
+		}
+
+		void Release(uint8* Ptr, int64 Capacity)
+		{
+			if(Ptr == nullptr)
+			{
+				return;
+			}
+
+			const int64 Budget = (int64)FMath::Max(0, CVarBufferPoolBudgetMB.GetValueOnAnyThread()) * 1024 * 1024;
+
+			FScopeLock Lock(&CriticalSection);
+
+			InUseBytes -= Capacity;
+
+			if(Capacity > Budget)
+			{
+				Free(Ptr, Capacity);
+				TrimmedBytes += Capacity;
+				return;
+			}
+
+			FreeList.Add({ Ptr, Capacity, FPlatformTime::Seconds() });
+			RetainedBytes += Capacity;
+
+			TrimLocked(Budget);
+		}
+
+		// Free buffers that have sat unused longer than the idle timeout.
+		void TrimIdle()
+		{
+			const double Cutoff = FPlatformTime::Seconds() - CVarBufferPoolIdleSeconds.GetValueOnAnyThread();
+
+			FScopeLock Lock(&CriticalSection);
+
+			for(int32 I = FreeList.Num() - 1; I >= 0; I--)
+			{
+				if(FreeList[I].ReleaseTime < Cutoff)
+				{
+					EvictLocked(I);
+				}
+			}
+		}
+
+		void Trim(int64 TargetBytes)
+		{
+			FScopeLock Lock(&CriticalSection);
+			TrimLocked(TargetBytes);
+		}
+
+		FDaylonLevellerBufferPoolStats GetStats() const
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			FDaylonLevellerBufferPoolStats Stats;
+			Stats.Hits          = Hits;
+			Stats.Misses        = Misses;
+			Stats.RetainedBytes = (uint64)RetainedBytes;
+			Stats.RetainedCount = (uint64)FreeList.Num();
+			Stats.InUseBytes    = (uint64)InUseBytes;
+			Stats.TrimmedBytes  = TrimmedBytes;
+			return Stats;
+		}
+
+	private:
+
+		struct FEntry
+		{
+			uint8* Ptr;
+			int64  Capacity;
+			double ReleaseTime;
+		};
+
+		mutable FCriticalSection CriticalSection;
+		TArray<FEntry>           FreeList;
+		int64                    RetainedBytes = 0;
+		int64                    InUseBytes    = 0;
+		uint64                   TrimmedBytes  = 0;
+		uint64                   Hits          = 0;
+		uint64                   Misses        = 0;
+
+		// Quarter-power-of-two steps in whole huge pages, so e.g. a 257 MB document
+		// takes a 320 MB buffer rather than a 512 MB one.
+		static int64 ClassSize(int64 Size)
+		{
+			Size = FMath::Max(Size, kMinClassSize);
+
+			const int64 Step = FMath::Max(kMinClassSize, (int64)(1ull << FMath::FloorLog2_64((uint64)Size)) / 4);
+
+			return Align(Size, Step);
+		}
+
+		// Pool memory comes straight from the OS rather than the engine allocator, so we
+		// own the pages outright and can ask for huge pages where the platform allows.
+		static uint8* Allocate(int64 Capacity)
+		{
+#if PLATFORM_LINUX
+			// mmap only guarantees page alignment, so reserve an extra huge page, keep the
+			// 2 MB-aligned span inside it and unmap the slack on either side. Capacity is a
+			// multiple of 2 MB, so the whole buffer is then eligible for huge pages.
+			const size_t Reserved = (size_t)(Capacity + kMinClassSize);
+			uint8*       Base     = (uint8*)::mmap(nullptr, Reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if(Base == (uint8*)MAP_FAILED)
+			{
+				return nullptr;
+			}
+
+			uint8*       Ptr  = Align(Base, kMinClassSize);
+			const size_t Head = (size_t)(Ptr - Base);
+			const size_t Tail = Reserved - Head - (size_t)Capacity;
+
+			if(Head != 0) { ::munmap(Base, Head); }
+			if(Tail != 0) { ::munmap(Ptr + Capacity, Tail); }
+
+			// Ask for transparent huge pages; harmless if the kernel declines.
+			::madvise(Ptr, (size_t)Capacity, MADV_HUGEPAGE);
+			return Ptr;
+#elif PLATFORM_WINDOWS
+			// Large pages would need SeLockMemoryPrivilege enabled in the process token,
+			// which editor processes don't have, so take ordinary committed pages.
+			return (uint8*)::VirtualAlloc(nullptr, (SIZE_T)Capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+			return (uint8*)FPlatformMemory::BinnedAllocFromOS((SIZE_T)Capacity);
+#endif
+		}
+
+		static void Free(uint8* Ptr, int64 Capacity)
+		{
+#if PLATFORM_LINUX
+			::munmap(Ptr, (size_t)Capacity);
+#elif PLATFORM_WINDOWS
+			::VirtualFree(Ptr, 0, MEM_RELEASE);
+#else
+			FPlatformMemory::BinnedFreeToOS(Ptr, (SIZE_T)Capacity);
+#endif
+		}
+
+		void EvictLocked(int32 Index)
+		{
+			const FEntry Entry = FreeList[Index];
+			FreeList.RemoveAt(Index, 1, EAllowShrinking::No);
+			RetainedBytes -= Entry.Capacity;
+			TrimmedBytes  += Entry.Capacity;
+			Free(Entry.Ptr, Entry.Capacity);
+		}
+
+		void TrimLocked(int64 TargetBytes)
+		{
+			// Oldest entries go first.
+			while(RetainedBytes > TargetBytes && FreeList.Num() > 0)
+			{
+				EvictLocked(0);
+			}
+		}
+};
+
+
+// Frees idle pool buffers while the editor runs; registered by the module.
+static FTSTicker::FDelegateHandle BufferPoolTrimTicker;
+
+
+// Move-only byte buffer whose storage comes from, and returns to, FLevellerBufferPool.
+class FLevellerBuffer
+{
+	uint8* Data     = nullptr;
+	int64  Size     = 0;
+	int64  Capacity = 0;
+
+	public:
+
+		FLevellerBuffer() = default;
+		~FLevellerBuffer() { Reset(); }
+
+		FLevellerBuffer(const FLevellerBuffer&) = delete;
+		FLevellerBuffer& operator=(const FLevellerBuffer&) = delete;
+
+		void Allocate(int64 InSize)
+		{
+			Reset();
+			Data = FLevellerBufferPool::Get().Acquire(InSize, Capacity);
+			Size = (Data != nullptr) ? InSize : 0;
+		}
+
+		void Reset()
+		{
+			FLevellerBufferPool::Get().Release(Data, Capacity);
+			Data     = nullptr;
+			Size     = 0;
+			Capacity = 0;
+		}
+
+		uint8*       GetData()             { return Data; }
+		const uint8* GetData()       const { return Data; }
+		int64        Num()           const { return Size; }
+		uint8        operator[](int64 I) const { check(I >= 0 && I < Size); return Data[I]; }
+};
+
+
 class FLevellerDocument
 {
 	uint64          Mark = 0;
 	
 	public:
 
-		TArray64<uint8> Contents;
+		FLevellerBuffer Contents;
 		uint64          DataOffset = 0;
 		uint64          DataLength = 0;
 		float           SpanLow    = 0.0f;
@@ -193,6 +464,7 @@ class FLevellerDocument
 		int32           Breadth    = 0;
 
 		FLandscapeFileInfo       Init         (const TCHAR* Filename);
+		bool                     Load         (const TCHAR* Filename);
 		void                     ComputeSpan  ();
 		bool                     Read         (uint64 Length, void* Buffer);
 		bool                     LocateData   (const char* Tag, uint64& Offset, uint64& Length);
@@ -325,7 +597,7 @@ FLandscapeFileInfo Daylon::FLevellerDocument::Init(const TCHAR* Filename)
 	FLandscapeFileInfo Result;
 	Result.ResultCode = ELandscapeImportResult::Success;
 
-	if (!FFileHelper::LoadFileToArray(Contents, Filename, FILEREAD_Silent))
+	if (!Load(Filename))
 	{
 		Result.ResultCode = ELandscapeImportResult::Error;
 		Result.ErrorMessage = LOCTEXT("DaylonLeveller_DocOpenError", "Error opening Leveller document");
@@ -448,6 +720,43 @@ FLandscapeFileInfo Daylon::FLevellerDocument::Init(const TCHAR* Filename)
 }
 
 
+bool Daylon::FLevellerDocument::Load(const TCHAR* Filename)
+{
+	// Like FFileHelper::LoadFileToArray, but into a pooled buffer.
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(Filename, FILEREAD_Silent));
+
+	if(!Reader)
+	{
+		return false;
+	}
+
+	const int64 Size = Reader->TotalSize();
+
+	if(Size < 5)
+	{
+		return false;
+	}
+
+	Contents.Allocate(Size);
+
+	if(Contents.GetData() == nullptr)
+	{
+		return false;
+	}
+
+	Reader->Serialize(Contents.GetData(), Size);
+
+	if(!Reader->Close())
+	{
+		Contents.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+
 void Daylon::FLevellerDocument::ComputeSpan()
 {
 	check(DataLength != 0 && Width != 0 && Breadth != 0);
@@ -564,6 +873,189 @@ bool Daylon::FLevellerDocument::Get(const char* Tag, double& N, FLandscapeFileIn
 }
 
 
+namespace Daylon
+{
+
+// Experimental hook for tools that want per-component bounds and mips; see
+// FDaylonLevellerLandscapeModule::SetComponentDataHook.
+static FCriticalSection                                    ComponentDataHookLock;
+static FDaylonLevellerComponentLayout                      ComponentDataLayout;
+static FDaylonLevellerLandscapeModule::FComponentDataHook ComponentDataHook;
+
+static bool GetComponentDataHook(FDaylonLevellerComponentLayout& Layout, FDaylonLevellerLandscapeModule::FComponentDataHook& Hook)
+{
+	FScopeLock Lock(&ComponentDataHookLock);
+
+	Layout = ComponentDataLayout;
+	Hook   = ComponentDataHook;
+
+	return (bool)Hook;
+}
+
+
+// Quantize the document's heights into Data. If ComponentData is given, the work is split
+// into component-sized tiles, and each tile's bounds and mips are built while its
+// samples are still in cache; otherwise rows are simply quantized in parallel.
+static void Quantize(const FLevellerDocument& Document, uint16* Data, FDaylonLevellerComponentData* ComponentData)
+{
+	const int32  Width    = Document.Width;
+	const int32  Breadth  = Document.Breadth;
+	const float  Low      = Document.SpanLow;
+	const float  Height   = Document.SpanHi - Document.SpanLow;
+	const float* HfPixels = (const float*)(Document.Contents.GetData() + Document.DataOffset);
+
+	// Map heights to full uint16 range; a flat document maps to all zeros. todo: preserve slope and use Z scale.
+	auto ToUint16 = [&](int64 I) -> uint16
+	{
+		return Height == 0.0f ? 0 : (uint16)FMath::RoundToInt(((HfPixels[I] - Low) / Height) * 0xFFFF);
+	};
+
+	if(ComponentData == nullptr)
+	{
+		ParallelFor(Breadth, [&](int32 Y)
+		{
+			for(int64 I = (int64)Y * Width, End = I + Width; I < End; I++)
+			{
+				Data[I] = ToUint16(I);
+			}
+		});
+		return;
+	}
+
+	auto& CD = *ComponentData;
+
+	const int32 SubQuads = CD.Layout.SubsectionSizeQuads;
+	const int32 NumSubs  = CD.Layout.NumSubsections;
+	const int32 Quads    = CD.Layout.GetComponentSizeQuads();
+	const int32 Verts    = Quads + 1;
+
+	CD.Width          = Width;
+	CD.Breadth        = Breadth;
+	CD.NumComponentsX = FMath::Max(1, FMath::DivideAndRoundUp(Width   - 1, Quads));
+	CD.NumComponentsY = FMath::Max(1, FMath::DivideAndRoundUp(Breadth - 1, Quads));
+
+	CD.MipSizes.Reset();
+	CD.MipOffsets.Reset();
+	CD.MipBlockSize = 0;
+
+	// Stop once a subsection's mip would have no quads left.
+	for(int32 SubVerts = (SubQuads + 1) >> 1; SubVerts >= 2; SubVerts >>= 1)
+	{
+		const int32 Size = SubVerts * NumSubs;
+
+		CD.MipSizes.Add(Size);
+		CD.MipOffsets.Add(CD.MipBlockSize);
+		CD.MipBlockSize += Size * Size;
+	}
+
+	CD.NumMips = CD.MipSizes.Num();
+
+	const int32 NumComponents = CD.NumComponentsX * CD.NumComponentsY;
+
+	CD.MinHeights.SetNumUninitialized(NumComponents);
+	CD.MaxHeights.SetNumUninitialized(NumComponents);
+	CD.Mips.SetNumUninitialized((int64)NumComponents * CD.MipBlockSize);
+
+	ParallelFor(NumComponents, [&](int32 C)
+	{
+		const int32 X0 = (C % CD.NumComponentsX) * Quads;
+		const int32 Y0 = (C / CD.NumComponentsX) * Quads;
+
+		// The component's vertices, with any overhang clamped to the heightmap's edge.
+		TArray<uint16, TInlineAllocator<64 * 64>> Tile;
+		Tile.SetNumUninitialized(Verts * Verts);
+
+		uint16 Lo = MAX_uint16;
+		uint16 Hi = 0;
+
+		for(int32 TY = 0; TY < Verts; TY++)
+		{
+			const int32 Y = FMath::Min(Y0 + TY, Breadth - 1);
+
+			// Edge vertices are shared with the next component over; only one of us writes them.
+			const bool bOwnsRow = (Y0 + TY == Y) && (TY < Quads || Y == Breadth - 1);
+
+			for(int32 TX = 0; TX < Verts; TX++)
+			{
+				const int32  X = FMath::Min(X0 + TX, Width - 1);
+				const int64  I = (int64)Y * Width + X;
+				const uint16 V = ToUint16(I);
+
+				Tile[TY * Verts + TX] = V;
+
+				Lo = FMath::Min(Lo, V);
+				Hi = FMath::Max(Hi, V);
+
+				if(bOwnsRow && (X0 + TX == X) && (TX < Quads || X == Width - 1))
+				{
+					Data[I] = V;
+				}
+			}
+		}
+
+		CD.MinHeights[C] = Lo;
+		CD.MaxHeights[C] = Hi;
+
+		// Resample each subsection's mip from its previous mip the way the landscape does:
+		// mip vertex I sits at I * PrevQuads / MipQuads in the previous mip and is
+		// bilinearly interpolated there, so border vertices map exactly onto the previous
+		// mip's border and adjacent subsections and components agree along shared edges.
+		// Mip 0 is the tile itself, whose subsections share their border vertices.
+		const uint16* Src         = Tile.GetData();
+		int32         SrcStride   = Verts;
+		int32         SrcSubVerts = SubQuads + 1;
+		int32         SrcSubStep  = SubQuads;
+
+		for(int32 Mip = 0; Mip < CD.NumMips; Mip++)
+		{
+			uint16*     Dst         = CD.Mips.GetData() + (int64)C * CD.MipBlockSize + CD.MipOffsets[Mip];
+			const int32 DstStride   = CD.MipSizes[Mip];
+			const int32 DstSubVerts = DstStride / NumSubs;
+
+			for(int32 SubY = 0; SubY < NumSubs; SubY++)
+			{
+				for(int32 SubX = 0; SubX < NumSubs; SubX++)
+				{
+					const uint16* SubSrc = Src + SubY * SrcSubStep * SrcStride + SubX * SrcSubStep;
+					uint16*       SubDst = Dst + SubY * DstSubVerts * DstStride + SubX * DstSubVerts;
+
+					for(int32 DY = 0; DY < DstSubVerts; DY++)
+					{
+						const float SY  = (float)(DY * (SrcSubVerts - 1)) / (DstSubVerts - 1);
+						const int32 SY0 = FMath::Min(FMath::FloorToInt(SY), SrcSubVerts - 1);
+						const int32 SY1 = FMath::Min(SY0 + 1,                SrcSubVerts - 1);
+						const float FY  = SY - SY0;
+
+						for(int32 DX = 0; DX < DstSubVerts; DX++)
+						{
+							const float SX  = (float)(DX * (SrcSubVerts - 1)) / (DstSubVerts - 1);
+							const int32 SX0 = FMath::Min(FMath::FloorToInt(SX), SrcSubVerts - 1);
+							const int32 SX1 = FMath::Min(SX0 + 1,                SrcSubVerts - 1);
+							const float FX  = SX - SX0;
+
+							const float Top    = FMath::Lerp((float)SubSrc[SY0 * SrcStride + SX0], (float)SubSrc[SY0 * SrcStride + SX1], FX);
+							const float Bottom = FMath::Lerp((float)SubSrc[SY1 * SrcStride + SX0], (float)SubSrc[SY1 * SrcStride + SX1], FX);
+
+							SubDst[DY * DstStride + DX] = (uint16)FMath::Clamp(FMath::RoundToInt(FMath::Lerp(Top, Bottom, FY)), 0, (int32)MAX_uint16);
+						}
+					}
+				}
+			}
+
+			// From mip 1 on, each subsection has its own copy of its border vertices.
+			Src         = Dst;
+			SrcStride   = DstStride;
+			SrcSubVerts = DstSubVerts;
+			SrcSubStep  = DstSubVerts;
+		}			Src     = Dst;
+			SrcSize = DstSize;
+		}
+	});
+}
+
+} // namespace Daylon
+
+
 
 class FDaylonLevellerHeightmapFileFormat : public ILandscapeHeightmapFileFormat 
 {
@@ -612,26 +1104,24 @@ class FDaylonLevellerHeightmapFileFormat : public ILandscapeHeightmapFileFormat
 				return Result;
 			}
 
-			const float Height = Document.SpanHi - Document.SpanLow;
+			// Every element is written by Quantize, so skip the zero fill.
+			Result.Data.SetNumUninitialized(Document.Width * Document.Breadth);
 
-			if(Height == 0.0f)
+			FDaylonLevellerComponentLayout                      Layout;
+			FDaylonLevellerLandscapeModule::FComponentDataHook Hook;
+
+			if(!Daylon::GetComponentDataHook(Layout, Hook))
 			{
-				// Document is flat, so just set all zeros into the result.
-				Result.Data.SetNum(0);
-				Result.Data.AddZeroed(Document.Width * Document.Breadth);
+				Daylon::Quantize(Document, Result.Data.GetData(), nullptr);
 				return Result;
 			}
 
-			// Document is not flat; map heights to full uint16 range. todo: preserve slope and use Z scale.
-
-			float* HfPixels = (float*)(Document.Contents.GetData() + Document.DataOffset);
+			auto ComponentData = MakeShared<FDaylonLevellerComponentData>();
+			ComponentData->Layout = Layout;
 
-			Result.Data.SetNum(Document.Width * Document.Breadth);
+			Daylon::Quantize(Document, Result.Data.GetData(), &ComponentData.Get());
 
-			for(int32 I = 0; I < Document.Width * Document.Breadth; I++)
-			{
-				Result.Data[I] = FMath::RoundToInt(((HfPixels[I] - Document.SpanLow) / Height) * 0xFFFF);
-			}
+			Hook(HeightmapFilename, MoveTemp(ComponentData));
 
 			return Result;
 		}
@@ -654,6 +1144,12 @@ void FDaylonLevellerLandscapeModule::StartupModule()
 	auto& Module = ModuleManager.GetModuleChecked<ILandscapeEditorModule>(FName("LandscapeEditor"));
 
 	Module.RegisterHeightmapFileFormat(MakeShareable(new FDaylonLevellerHeightmapFileFormat()));
+
+	Daylon::BufferPoolTrimTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+	{
+		Daylon::FLevellerBufferPool::Get().TrimIdle();
+		return true;
+	}), 5.0f);
 }
 
 
@@ -661,8 +1157,63 @@ void FDaylonLevellerLandscapeModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FTSTicker::GetCoreTicker().RemoveTicker(Daylon::BufferPoolTrimTicker);
+	TrimBufferPool();
+	ClearComponentDataHook();
 }
 
+
+FDaylonLevellerBufferPoolStats FDaylonLevellerLandscapeModule::GetBufferPoolStats()
+{
+	return Daylon::FLevellerBufferPool::Get().GetStats();
+}
+
+
+void FDaylonLevellerLandscapeModule::TrimBufferPool()
+{
+	Daylon::FLevellerBufferPool::Get().Trim(0);
+}
+
+
+bool FDaylonLevellerLandscapeModule::SetComponentDataHook(const FDaylonLevellerComponentLayout& Layout, FComponentDataHook Hook)
+{
+	if(!Layout.IsValid())
+	{
+		UE_LOG(LogDaylonLevellerLandscape, Warning, TEXT("Unsupported landscape component layout (%d quads per subsection, %d subsections); component data hook not set"),
+			Layout.SubsectionSizeQuads, Layout.NumSubsections);
+		return false;
+	}
+
+	FScopeLock Lock(&Daylon::ComponentDataHookLock);
+
+	Daylon::ComponentDataLayout = Layout;
+	Daylon::ComponentDataHook   = MoveTemp(Hook);
+	return true;
+}
+
+
+void FDaylonLevellerLandscapeModule::ClearComponentDataHook()
+{
+	FScopeLock Lock(&Daylon::ComponentDataHookLock);
+
+	Daylon::ComponentDataHook = nullptr;
+}
+
+
+static FAutoConsoleCommand CmdBufferPoolStats(
+	TEXT("Daylon.Leveller.BufferPoolStats"),
+	TEXT("Log hit rate and retained memory of the Leveller document buffer pool."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const auto Stats = FDaylonLevellerLandscapeModule::GetBufferPoolStats();
+
+		UE_LOG(LogDaylonLevellerLandscape, Log, TEXT("Buffer pool: %llu hits, %llu misses (%.1f%% hit rate), %llu buffers / %.1f MB retained, %.1f MB in use, %.1f MB trimmed"),
+			Stats.Hits, Stats.Misses, Stats.GetHitRate() * 100.0,
+			Stats.RetainedCount, Stats.RetainedBytes / (1024.0 * 1024.0),
+			Stats.InUseBytes / (1024.0 * 1024.0), Stats.TrimmedBytes / (1024.0 * 1024.0));
+	}));
+
 #undef LOCTEXT_NAMESPACE
 	
 IMPLEMENT_MODULE(FDaylonLevellerLandscapeModule, DaylonLevellerLandscape)
\ No newline at end of file
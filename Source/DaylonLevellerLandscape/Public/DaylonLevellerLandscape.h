@@ -7,11 +7,107 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDaylonLevellerLandscape, Log, All);
 
-class FDaylonLevellerLandscapeModule : public IModuleInterface
+/** Counters for the buffer pool that backs Leveller document loads. */
+struct FDaylonLevellerBufferPoolStats
+{
+	uint64 Hits          = 0;
+	uint64 Misses        = 0;
+	uint64 RetainedBytes = 0;
+	uint64 RetainedCount = 0;
+	uint64 InUseBytes    = 0;
+	uint64 TrimmedBytes  = 0;
+
+	double GetHitRate() const
+	{
+		const uint64 Total = Hits + Misses;
+		return Total == 0 ? 0.0 : (double)Hits / (double)Total;
+	}
+};
+
+/** Landscape component layout to tile Leveller imports into. */
+struct FDaylonLevellerComponentLayout
+{
+	int32 SubsectionSizeQuads = 63;  // 7, 15, 31, 63, 127 or 255
+	int32 NumSubsections      = 1;   // per side, 1 or 2
+
+	int32 GetComponentSizeQuads() const
+	{
+		return SubsectionSizeQuads * NumSubsections;
+	}
+
+	bool IsValid() const
+	{
+		return SubsectionSizeQuads >= 7 && SubsectionSizeQuads <= 255 && FMath::IsPowerOfTwo(SubsectionSizeQuads + 1)
+			&& (NumSubsections == 1 || NumSubsections == 2);
+	}
+};
+
+/**
+ * Experimental. Per-component height bounds and mip chain, produced by the Leveller
+ * importer in the same pass that quantizes the heightmap. Heights are in the imported
+ * uint16 range. Components share their edge vertices, so each covers
+ * GetComponentSizeQuads() + 1 vertices per side (clamped to the heightmap's edge where
+ * a component overhangs it).
+ *
+ * Mips follow the landscape's own scheme: each subsection's mip N has
+ * ((SubsectionSizeQuads + 1) >> N) vertices per side and keeps its border vertices
+ * fixed, so neighbours stay seamless. A component's mip holds its subsections side by
+ * side, as in the landscape's heightmap texture.
+ */
+struct FDaylonLevellerComponentData
+{
+	FDaylonLevellerComponentLayout Layout;
+
+	int32 Width          = 0;
+	int32 Breadth        = 0;
+	int32 NumComponentsX = 0;
+	int32 NumComponentsY = 0;
+	int32 NumMips        = 0;    // excluding mip 0, which is the imported heightmap itself
+	int32 MipBlockSize   = 0;    // total samples of all mips of one component
+
+	TArray<uint16> MinHeights;   // one per component, row-major
+	TArray<uint16> MaxHeights;
+	TArray<int32>  MipSizes;     // vertices per side of mips 1..NumMips, across all subsections
+	TArray<int32>  MipOffsets;   // start of mips 1..NumMips within a component's block
+	TArray<uint16> Mips;         // each component's block, back to back
+
+	int32 GetComponentIndex(int32 ComponentX, int32 ComponentY) const
+	{
+		return ComponentY * NumComponentsX + ComponentX;
+	}
+
+	/** Row-major samples of the given mip (1..NumMips) of a component. */
+	TArrayView<const uint16> GetMip(int32 ComponentX, int32 ComponentY, int32 Mip) const
+	{
+		check(Mip >= 1 && Mip <= NumMips);
+		const int32 Size = MipSizes[Mip - 1];
+		return TArrayView<const uint16>(Mips.GetData() + (int64)GetComponentIndex(ComponentX, ComponentY) * MipBlockSize + MipOffsets[Mip - 1], Size * Size);
+	}
+};
+
+class DAYLONLEVELLERLANDSCAPE_API FDaylonLevellerLandscapeModule : public IModuleInterface
 {
 public:
 
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	/** Snapshot of the document buffer pool's counters. */
+	static FDaylonLevellerBufferPoolStats GetBufferPoolStats();
+
+	/** Release every buffer the pool is holding onto. */
+	static void TrimBufferPool();
+
+	using FComponentDataHook = TFunction<void(const TCHAR* HeightmapFilename, TSharedRef<const FDaylonLevellerComponentData> Data)>;
+
+	/**
+	 * Experimental. While a hook is set, Import also tiles the heightmap into components
+	 * of the given layout, computes their bounds and mips in the same pass, and hands the
+	 * result to the hook on the importing thread. The hook owns the data from then on.
+	 * Returns false, and leaves any previous hook in place, if the layout isn't one the
+	 * landscape supports.
+	 */
+	static bool SetComponentDataHook(const FDaylonLevellerComponentLayout& Layout, FComponentDataHook Hook);
+	static void ClearComponentDataHook();
 };